@@ -8,8 +8,47 @@ cd "$(dirname "$0")/.."
 # Made-up headings that are allowed in src/sicp/*.ss.
 heading_exceptions=(
 	"A sample simulation"
+    "A benchmark corpus"
+    "A heap-based agenda"
+    "Adaptive term lists"
+    "Atomic operations"
+    "Balanced trees"
+    "Benchmarking chunked streams"
+    "Benchmarking differentiation"
+    "Benchmarking flonum kernels"
+    "Benchmarking fusion"
+    "Benchmarking Huffman coding"
+    "Benchmarking memoization"
+    "Benchmarking Monte Carlo"
+    "Benchmarking nondeterministic search"
+    "Benchmarking polynomial arithmetic"
+    "Benchmarking queries"
+    "Benchmarking sets"
+    "Benchmarking stream fusion"
+    "Benchmarking the agenda"
+    "Benchmarking the evaluators"
+    "Benchmarking unification"
+    "Chunked streams"
+    "Comparing compiled and interpreted code"
+    "Flonum kernels"
+    "Fusing sequence operations"
+    "Fusing stream operations"
+    "Hash-consed expressions"
+    "Hashed memoization"
+    "Hashed tables"
+    "Lexical addressing"
+    "Optimizing applications"
     "One-dimensional tables"
+    "Parallel Monte Carlo"
+    "Persistent hash maps"
     "Primitive procedures"
+    "Pruning the search"
+    "Rasterizing pictures"
+    "Serializer contention"
+    "Strictness analysis"
+    "Stress testing the collector"
+    "Structure-sharing unification"
+    "Table-driven coding"
 )
 
 heading_exceptions_pattern="^$(IFS=\|; echo "${heading_exceptions[*]}")$"